@@ -24,6 +24,11 @@ z_length = 6
     ymin = -1
     zmin = -6
   []
+  # Cost-weighted partitioning: uncomment together with the repartitioner in [UserObjects]
+  #[Partitioner]
+  #  type = ConstitutiveCostPartitioner
+  #  cost_variable = constitutive_cost
+  #[]
   [sub1] # define the gauge length within RVE
     input = cube
     type = SubdomainBoundingBoxGenerator
@@ -100,6 +105,10 @@ z_length = 6
     order = FIRST
     family = MONOMIAL
   [../]
+  [./constitutive_cost] # number of slip law evaluations per constitutive update, used for load balancing
+    order = CONSTANT
+    family = MONOMIAL
+  [../]
   [./crss_gp_shear]
     order = CONSTANT
     family = MONOMIAL
@@ -552,6 +561,12 @@ z_length = 6
     property = ave_damage
     execute_on = timestep_end
   [../]
+  [./constitutive_cost]
+    type = MaterialRealAux
+    variable = constitutive_cost
+    property = constitutive_cost
+    execute_on = timestep_end
+  [../]
   [./SB_initiation_strain]
     type = MaterialRealAux
     variable = SB_initiation_strain
@@ -1182,6 +1197,21 @@ z_length = 6
     crystal_plasticity_models = 'trial_xtalpl'
     eigenstrain_names = residual_eigenstrain
     tan_mod_type = exact
+    # use_trust_region = true # dogleg globalization of the local stress solve, reports trust_region_steps / trust_region_rejections
+    # trust_region_initial_radius = 100
+    # lazy_diagnostics = true # strain measures computed once per step at timestep_end, not in the solve; epsilon_p/epsilon_total feed strain_zz_old and local_strain_* every step
+    # diagnostics_interval = 20 # must match the Exodus interval: epsilon_e, total_lagrangian_strain and updated_rotation only on the output steps
+    # state_variable_acceleration = anderson # Anderson acceleration of the state variable iteration
+    # anderson_history = 3
+    # integration_mode = adaptive_explicit # explicit update during holds, falls back to the implicit solve, reports explicit_updates / explicit_fallbacks
+    # jacobian_reuse = true # modified Newton in the stress update, reports jacobian_rebuilds / jacobian_reuses
+    # jacobian_reuse_contraction = 0.5
+    # use_elastic_predictor = true # skips the plastic solve when the slip at the trial stress is negligible, reports elastic_predictor_updates
+    # elastic_predictor_tolerance = 1e-6
+    # memoize_update = true # reuses the last update when the deformation gradient is unchanged, reports memoization_hits / memoization_misses
+    # active_set_tolerance = 0.5 # only slip systems with |tau| / slip resistance above this ratio enter the stress iterations, reports active_slip_systems
+    # reduced_integration = true # one constitutive update per element with the averaged deformation gradient
+    # hourglass_stiffness = 1.0 # fraction of the elastic stiffness acting on the strain fluctuation at the quadrature points
   [../]
   [residual_eigenstrain] # load the residual deformation as the thermal expansion distribution across inter-dendrite to dendrite core
     type = ComputeCrystalPlasticityResidualEigenstrain
@@ -1189,12 +1219,14 @@ z_length = 6
     deformation_gradient_name = thermal_deformation_gradient
     temperature = temperature
     uniform = 0
+    dendrite_geometry = dendrite_geometry
     residual_expansion_coefficients = '0 0 1E-2' # governing the intensity of residual deformation/stresses and initial dislocation density
   []
   [./trial_xtalpl] # define the plastic properties based on the crystal plasticity model
     type = CrystalPlasticityDislocationDendrite
     number_slip_systems = 12
     slip_sys_file_name = input_slip_sys.txt # load the slip system of FCC
+    dendrite_geometry = dendrite_geometry
      
     # parameters in the crystal-plasticity model
   	ao =  0.05E-4 # reference slip rate
@@ -1236,6 +1268,8 @@ z_length = 6
   	dslip_increment_dedge = dslip_increment_dedge
   	dslip_increment_dscrew = dslip_increment_dscrew
   	print_state_variable_convergence_error_messages = true
+    # diagnostic_storage = none # drop the output-only epsilon_e, 110_yy/xy and ini_e_*: remove the epsilon_e_zz, plane_yy/xy, copy_plane_* and plane_*_dic objects first
+    # epsilon_p and epsilon_total are always kept, they drive strain_zz_old (slip band trigger) and local_strain_*
   [../]
   
   # convert the coordinate of strain within RVE onto the observation plane in DIC, for the comparison between CPFE and DIC results
@@ -1331,18 +1365,6 @@ z_length = 6
     function = average_strain
     execute_on = timestep_end
   [../]
-  [./local_crss_interdendrite]
-    type = PointValue
-    variable = slip_resistance_gamma
-    point = '0 0 0'
-    execute_on = timestep_end
-  [../]
-  [./local_crss_dendrite_core]
-    type = PointValue
-    variable = slip_resistance_gamma
-    point = '-1 1 -2' 
-    execute_on = timestep_end
-  [../]
   [./min_crss_shear]
     type = ElementExtremeValue
     variable = crss_gp_shear
@@ -1367,18 +1389,6 @@ z_length = 6
     block = 2
     execute_on = timestep_end
   [../]
-  [./local_damage_dendrite_core]
-     type = PointValue
-     variable = ave_damage
-     point = '-1 1 -2'
-     execute_on = timestep_end
-  [../]
-  [./local_damage_interdendrite]
-     type = PointValue
-     variable = ave_damage
-     point = '0 0 0'
-     execute_on = timestep_end
-  [../]
   [./global_strain]  # the engineering strain used in stress-strain curves
     type = FunctionValuePostprocessor
     function = global_strain
@@ -1401,6 +1411,18 @@ z_length = 6
   [../]
 []
 
+[Reporters] # local values at the interdendrite (0 0 0) and dendrite core (-1 1 -2)
+  # scalar values local_probe/<variable>_<point name> (e.g. local_probe/ave_damage_interdendrite)
+  # written as columns of the main .csv file, replacing the former local_crss_* and local_damage_*
+  [./local_probe]
+    type = MultiQuantityProbe
+    points = '0 0 0 -1 1 -2'
+    point_names = 'interdendrite dendrite_core'
+    variables = 'slip_resistance_gamma ave_damage'
+    execute_on = timestep_end
+  [../]
+[]
+
 [Functions] # Functions used in Postprocessors
   [average_strain]
     type = ParsedFunction
@@ -1423,6 +1445,20 @@ z_length = 6
 	  nprop = 5
     read_type = element
   [../]
+  #[./repartitioner] # rebalances the mesh every 10 steps if the constitutive cost per processor is imbalanced
+  #  type = ConstitutiveCostRepartitioner
+  #  cost_variable = constitutive_cost
+  #  interval = 10
+  #[../]
+  #[./memory_report] # bytes per qp and total memory of each material property, current and old states
+  #  type = MaterialPropertyMemoryReport
+  #  materials = 'trial_xtalpl stress'
+  #[../]
+  [./dendrite_geometry] # dendrite centre(s), normalized distance and core region cached at every quadrature point
+    type = DendriteGeometry
+    centers = '0 0 0'
+    half_spacing = 1
+  [../]
 []
 
 [Preconditioning]
@@ -1432,6 +1468,29 @@ z_length = 6
   [../]
 []
 
+# Slip-band-driven h-adaptivity: uncomment to refine around the slip band and coarsen elsewhere.
+# Per-element microstructure files are indexed by the elements of the initial mesh.
+#[Adaptivity]
+#  marker = sb_marker
+#  max_h_level = 2
+#  [Markers]
+#    [sb_marker]
+#      type = SlipBandMarker
+#      variable = inside_sb_region
+#      D1_old = D1_old
+#      D2_old = D2_old
+#      buffer_width = 0.2
+#      indicator = damage_jump
+#      indicator_threshold = 0.05
+#    []
+#  []
+#  [Indicators]
+#    [damage_jump] # ave_damage is constant per element, its jump across the faces replaces the gradient
+#      type = ValueJumpIndicator
+#      variable = ave_damage
+#    []
+#  []
+#[]
 [Executioner] # setup for the solver of FEM
   type = Transient
   solve_type = 'NEWTON'
@@ -1462,6 +1521,13 @@ z_length = 6
     type = Exodus
     interval = 20
   [../]
+  # elemental fields written by a background thread, without stalling the solve
+  #[./case_980_async]
+  #  type = AsyncElementalOutput
+  #  elemental_variables = 'ave_damage slip_resistance_gamma epsilon_p_zz'
+  #  time_step_interval = 20
+  #  flush_interval = 10000 # same as the checkpoint interval
+  #[../]
   [./case_980_32_no3]
     type = Checkpoint
     time_step_interval = 10000
@@ -0,0 +1,97 @@
+#pragma once
+
+#include "FileOutput.h"
+
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+/**
+ * AsyncElementalOutput writes elemental (monomial) variables to one CSV file per output step
+ * and processor without stalling the solve: the values of the local elements are copied
+ * into a snapshot that is queued for a background writer thread, and the next time step
+ * starts immediately. When the queue holds buffer_size snapshots the solve waits for the
+ * writer (backpressure). The queue is flushed at the end of the simulation, at the end of
+ * every flush_interval-th time step (e.g. matching the checkpoint interval), whether or not
+ * this output writes on that step, and when the object is destroyed.
+ */
+class AsyncElementalOutput : public FileOutput
+{
+public:
+  static InputParameters validParams();
+
+  AsyncElementalOutput(const InputParameters & parameters);
+
+  virtual ~AsyncElementalOutput();
+
+  virtual void initialSetup() override;
+  virtual void meshChanged() override;
+
+  virtual std::string filename() override;
+
+  /// flushes the queue on the flush steps, called on every execute flag
+  virtual void outputStep(const ExecFlagType & type) override;
+
+protected:
+  virtual void output() override;
+
+  /// element ids and centroids of the local elements, shared by the snapshots until the mesh changes
+  struct Geometry
+  {
+    std::vector<dof_id_type> ids;
+    std::vector<Point> centroids;
+  };
+
+  /// values of the variables on the local elements at one output step
+  struct Snapshot
+  {
+    std::string file_name;
+    Real time;
+    std::shared_ptr<const Geometry> geometry;
+    std::vector<Real> values;
+  };
+
+  /// collects the local elements and their centroids
+  void updateGeometry();
+
+  /// waits until the writer thread has written all the queued snapshots
+  void flush();
+
+  /// loop of the writer thread
+  void writerLoop();
+
+  /// writes one snapshot to its file, returns false if the file cannot be opened
+  bool writeSnapshot(const Snapshot & snapshot) const;
+
+  /// names of the elemental variables to write
+  const std::vector<VariableName> & _variable_names;
+
+  /// maximum number of queued snapshots before the solve waits for the writer
+  const unsigned int _buffer_size;
+
+  /// number of time steps between two flushes, 0 to flush only at the end
+  const unsigned int _flush_interval;
+
+  ///@{ system and variable number of each variable
+  std::vector<const libMesh::System *> _systems;
+  std::vector<unsigned int> _variable_numbers;
+  ///@}
+
+  ///@{ local elements, rebuilt when the mesh changes
+  std::vector<const Elem *> _elems;
+  std::shared_ptr<const Geometry> _geometry;
+  ///@}
+
+  ///@{ queue of snapshots shared with the writer thread
+  std::deque<Snapshot> _queue;
+  std::mutex _mutex;
+  std::condition_variable _condition;
+  bool _writing;
+  bool _stop;
+  std::vector<std::string> _failed_files;
+  ///@}
+
+  std::thread _writer;
+};
@@ -9,6 +9,8 @@
 #include "ComputeCrystalPlasticityEigenstrainBase.h"
 #include "DerivativeMaterialInterface.h"
 
+class DendriteGeometry;
+
 /**
  * ComputeCrystalPlasticityThermalEigenstrain computes an eigenstrain for thermal expansion
  * with a constant thermal expansion coefficient.
@@ -44,5 +46,8 @@ protected:
   double pre_factor();
   
   const int _uniform;
+
+  /// Optional dendrite geometry, a single dendrite at the origin is assumed if not provided
+  const DendriteGeometry * const _dendrite_geometry;
 };
 
@@ -8,6 +8,8 @@
 #include "RankTwoTensor.h"
 #include "RankFourTensor.h"
 
+#include <unordered_map>
+
 /**
  * ComputeDislocationCrystalPlasticityStress (used together with CrystalPlasticityDislocationDendriteBase)
  * uses the multiplicative decomposition of the deformation gradient and solves the PK2 stress
@@ -29,6 +31,9 @@ public:
 
   virtual void initialSetup() override;
 
+  /// clears the memoized updates of the previous time step
+  virtual void timestepSetup() override;
+
 protected:
   virtual void computeQpStress() override;
 
@@ -59,6 +64,9 @@ protected:
    */
   void preSolveQp();
 
+  /// zeroes the counters of the work done by the constitutive update at a quadrature point
+  void zeroUpdateCounters();
+
   /**
    * Solve the stress and internal state variables (e.g. slip increment,
    * slip system resistance) at each qp points
@@ -70,12 +78,45 @@ protected:
    */
   void postSolveQp(RankTwoTensor & stress_new, RankFourTensor & jacobian_mult);
 
+  /**
+   * Semi-implicit update of the stress and state variables over a substep:
+   * the slip rates are evaluated at the stress at the start of the substep,
+   * the implicit stress residual at the resulting stress is used as error estimate
+   * and the state variables are updated once. Returns false if the error estimate,
+   * the slip increment or the state variable change exceed their tolerances.
+   */
+  bool explicitUpdate();
+
+  /**
+   * Elastic predictor over the whole time step: the trial stress with the plastic
+   * deformation gradient of the previous step bounds the stress of the plastic solution,
+   * so if the slip increments at the trial stress are all below the tolerance the
+   * update is accepted after one stress correction and one state variable update,
+   * without Newton iterations. Returns false if the plastic solve is needed.
+   */
+  bool elasticPredictor();
+
+  /**
+   * Single update of the state variables at the current stress, followed by the
+   * slip resistance; returns false if their change exceeds the model tolerances
+   */
+  bool updateStateVariablesOnce();
+
   /**
    * Solves the internal variables stress as a function of the slip specified
    * by the constitutive model defined in the inheriting class
    */
   void solveStateVariables();
 
+  /**
+   * Anderson acceleration of the state variable iteration: combines the last
+   * iterates to compute the next state variables from the current iterate
+   * (state before update) and the updated state variables of the models.
+   * Falls back to the plain fixed-point update, and restarts the history,
+   * if the fixed-point residual grows or the accelerated state is not admissible.
+   */
+  void accelerateStateVariables();
+
   /**
    * solves for stress, updates plastic deformation gradient.
    */
@@ -93,6 +134,7 @@ protected:
    * Calculates the jacobian as
    * $\mathbf{J} = \mathbf{I} - \mathbf{C} \frac{d\mathbf{E}^e}{d\mathbf{F}^e}
    * \frac{d\mathbf{F}^e}{d\mathbf{F}^P^{-1}} \frac{d\mathbf{F}^P^{-1}}{d\mathbf{PK2}}$
+   * and its inverse
    */
   void calculateJacobian();
 
@@ -102,9 +144,44 @@ protected:
   void elastoPlasticTangentModuli(RankFourTensor & jacobian_mult);
   ///@}
 
+  /// adds the derivative of the hourglass stress of reduced integration to the tangent moduli
+  void hourglassTangentModuli(const RankTwoTensor & hourglass_pk2, RankFourTensor & jacobian_mult);
+
   /// performs the line search update
   bool lineSearchUpdate(const Real & rnorm_prev, const RankTwoTensor & dpk2);
 
+  /**
+   * Reduced integration: one constitutive update per element, at the first quadrature point,
+   * with the volume averaged deformation gradient. The material properties are copied to the
+   * other quadrature points, where an hourglass stress proportional to the deviation of the
+   * strain from the element average is added (also to the tangent moduli) and the slip rates
+   * are evaluated at the stabilized stress, so that the slip increment still varies within the
+   * element (GNDs). The first quadrature point keeps the solved slip increment, which produced
+   * the state of the element.
+   */
+  void computeQpReducedStress();
+
+  /// copies the current material properties supplied by material from from_qp to to_qp
+  void copyQpProperties(const MaterialBase & material, unsigned int to_qp, unsigned int from_qp);
+
+  /**
+   * Newton iterations of the stress, in which the models only evaluate
+   * and linearize their active slip systems. Returns the norm of the initial residual.
+   */
+  Real solveActiveStress();
+
+  /**
+   * Classifies the slip systems of the models as active or inactive at the current stress,
+   * rebuilding the active sets if reset. Returns true if an inactive slip system was activated.
+   */
+  bool updateActiveSlipSystems(bool reset);
+
+  /**
+   * performs one trust region (dogleg) update of the stress,
+   * returns false if the trust region radius falls below the minimum
+   */
+  bool trustRegionUpdate(Real & rnorm);
+
   /**
    * Calculates the deformation gradient due to eigenstrain
    */
@@ -142,6 +219,21 @@ protected:
   RankTwoTensor _residual_tensor;
   /// Jacobian tensor
   RankFourTensor _jacobian;
+  /// Inverse of the jacobian, used for the Newton and trust region steps
+  RankFourTensor _inverse_jacobian;
+  /// Whether the inverse jacobian was computed during the current update at the quadrature point
+  bool _inverse_jacobian_valid;
+
+  /// Flag to reuse the jacobian over the iterations and substeps (modified Newton)
+  const bool _jacobian_reuse;
+
+  /// The jacobian is rebuilt when the residual norm decreases by less than this factor in an iteration
+  const Real _jacobian_reuse_contraction;
+
+  ///@{ Number of jacobian evaluations and of iterations reusing a previous jacobian at a quadrature point
+  MaterialProperty<Real> * _jacobian_rebuilds;
+  MaterialProperty<Real> * _jacobian_reuses;
+  ///@}
 
   /// Maximum number of iterations for stress update
   unsigned int _maxiter;
@@ -172,6 +264,81 @@ protected:
   /// strain formulation
   const enum class LineSearchMethod { CutHalf, Bisection } _line_search_method;
 
+  /// Integration of the constitutive update: implicit, or explicit with fallback to implicit
+  const enum class IntegrationMode { IMPLICIT, ADAPTIVE_EXPLICIT } _integration_mode;
+
+  /// Maximum slip increment in a substep for the explicit update
+  const Real _explicit_slip_increment_tolerance;
+
+  /// Tolerance on the stress residual at the end of the explicit update, relative to the stress
+  const Real _explicit_error_tolerance;
+
+  ///@{ Number of substeps integrated explicitly and of explicit updates that fell back to the implicit solve
+  MaterialProperty<Real> * _explicit_updates;
+  MaterialProperty<Real> * _explicit_fallbacks;
+  ///@}
+
+  /// Flag to try the elastic predictor before the plastic solve
+  const bool _use_elastic_predictor;
+
+  /// Maximum slip increment over the time step for which the elastic predictor is accepted
+  const Real _elastic_predictor_tolerance;
+
+  /// 1 if the elastic predictor was accepted in the last update at a quadrature point, 0 otherwise
+  MaterialProperty<Real> * _elastic_predictor_updates;
+
+  /// Acceleration of the state variable fixed-point iteration
+  const enum class StateVariableAcceleration { NONE, ANDERSON } _state_variable_acceleration;
+
+  /// Maximum number of previous iterates used by the Anderson acceleration
+  const unsigned int _anderson_history;
+
+  ///@{ Anderson acceleration: state variables before the update, previous residual and update, their differences
+  std::vector<Real> _anderson_state;
+  std::vector<Real> _anderson_residual_old;
+  std::vector<Real> _anderson_update_old;
+  Real _anderson_residual_norm_old;
+  std::vector<std::vector<Real>> _anderson_residual_differences;
+  std::vector<std::vector<Real>> _anderson_update_differences;
+  ///@}
+
+  /// Ratio of the resolved shear stress to the slip resistance below which a slip system is inactive
+  const Real _active_set_tolerance;
+
+  /// Number of active slip systems at the end of the last stress solve at a quadrature point
+  MaterialProperty<Real> * _active_slip_systems;
+
+  /// Flag to use one constitutive update per element with hourglass stabilization
+  const bool _reduced_integration;
+
+  /// Fraction of the elastic stiffness used for the hourglass stress in reduced integration
+  const Real _hourglass_stiffness;
+
+  ///@{ Volume averaged deformation gradient of the element, used in reduced integration
+  RankTwoTensor _average_deformation_gradient;
+  RankTwoTensor _average_deformation_gradient_old;
+  ///@}
+
+  /// Volume of the element, the weight of a point in the average is its JxW divided by it
+  Real _element_volume;
+
+  /// Flag to activate the trust region (dogleg) update of the stress
+  const bool _use_trust_region;
+
+  ///@{ Initial, minimum and maximum trust region radius
+  const Real _trust_region_initial_radius;
+  const Real _trust_region_min_radius;
+  const Real _trust_region_max_radius;
+  ///@}
+
+  /// Trust region radius, carried over the iterations and substeps at a quadrature point
+  Real _trust_region_radius;
+
+  ///@{ Number of trial steps and of rejected steps of the trust region update at a quadrature point
+  MaterialProperty<Real> * _trust_region_steps;
+  MaterialProperty<Real> * _trust_region_rejections;
+  ///@}
+
   ///@{Plastic deformation gradient RankTwoTensor for the crystal
   MaterialProperty<RankTwoTensor> & _plastic_deformation_gradient;
   const MaterialProperty<RankTwoTensor> & _plastic_deformation_gradient_old;
@@ -192,6 +359,10 @@ protected:
   const MaterialProperty<RankTwoTensor> & _pk2_old;
   ///@}
 
+  /// Number of residual evaluations (slip law evaluations) in the last constitutive update,
+  /// used as a measure of the constitutive cost for load balancing
+  MaterialProperty<Real> & _constitutive_cost;
+
   /// Lagrangian total strain measure for the entire crystal
   MaterialProperty<RankTwoTensor> & _total_lagrangian_strain;
 
@@ -215,6 +386,47 @@ protected:
   RankTwoTensor _inverse_eigenstrain_deformation_grad;
   ///@}
 
+  /**
+   * Flag to compute the derived quantities that are not used in the solve (strain measures of
+   * the models, total Lagrangian strain, updated rotation) only outside of the residual and
+   * Jacobian evaluations, e.g. when auxiliary kernels request them at the end of the time step
+   */
+  const bool _lazy_diagnostics;
+
+  /// Number of time steps between two evaluations of the quantities only written to the output
+  const unsigned int _diagnostics_interval;
+
+  /**
+   * Flag to reuse the result of the last constitutive update of an element in the residual
+   * and Jacobian evaluations when the deformation gradient, the temperature, the time and
+   * the time step are unchanged: the stateful state variables still hold that result
+   */
+  const bool _memoize_update;
+
+  /// Result of the last constitutive update at a quadrature point
+  struct MemoizedUpdate
+  {
+    RankTwoTensor stress;
+    RankTwoTensor deformation_gradient;
+    RankFourTensor tangent;
+    /// temperature, time and time step of the update
+    RealVectorValue conditions;
+    Real hits = 0.0;
+    Real misses = 0.0;
+  };
+
+  /**
+   * Last constitutive update of each quadrature point of the elements evaluated by this thread
+   * in the current time step, keyed by element id. Cleared at the beginning of each time step,
+   * so it also never outlives a mesh change.
+   */
+  std::unordered_map<dof_id_type, std::vector<MemoizedUpdate>> _memoized_updates;
+
+  ///@{ Number of memoized (hits) and computed (misses) updates in the solve of the current time step
+  MaterialProperty<Real> * _memoization_hits;
+  MaterialProperty<Real> * _memoization_misses;
+  ///@}
+
   /// Flag to print to console warning messages on stress, constitutive model convergence
   const bool _print_convergence_message;
   
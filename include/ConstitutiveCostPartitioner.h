@@ -0,0 +1,31 @@
+#pragma once
+
+#include "PetscExternalPartitioner.h"
+
+/**
+ * ConstitutiveCostPartitioner partitions the mesh with element weights taken from an
+ * elemental variable holding the measured constitutive cost of each element
+ * (e.g. the constitutive_cost material property of ComputeDislocationCrystalPlasticityStress
+ * through a MaterialRealAux), so that elements in the slip band or the dendrite core,
+ * which need many more substeps and Newton iterations, are spread over the processors.
+ * Before the variable is available (initial partitioning) all elements have unit weight.
+ * Used together with ConstitutiveCostRepartitioner to rebalance during the simulation.
+ */
+class ConstitutiveCostPartitioner : public PetscExternalPartitioner
+{
+public:
+  static InputParameters validParams();
+
+  ConstitutiveCostPartitioner(const InputParameters & params);
+
+  virtual std::unique_ptr<Partitioner> clone() const override;
+
+  virtual dof_id_type computeElementWeight(Elem & elem) override;
+
+protected:
+  /// elemental variable with the constitutive cost
+  const VariableName _cost_variable;
+
+  /// factor applied to the cost before rounding to an integer weight
+  const Real _cost_scale;
+};
@@ -0,0 +1,42 @@
+#pragma once
+
+#include "GeneralUserObject.h"
+
+/**
+ * ConstitutiveCostRepartitioner periodically repartitions the mesh with the partitioner
+ * of the mesh (ConstitutiveCostPartitioner to use the measured constitutive cost as
+ * element weights) when the cost summed over the elements of each processor is
+ * imbalanced. It runs at the beginning of a time step, before the solve, so the user
+ * objects, postprocessors and outputs of a step all see the same mesh. The solution is
+ * moved to the new owners of the elements by the framework when the mesh changes.
+ *
+ * Experimental: that the stateful material properties follow the elements on a replicated
+ * mesh has not been verified yet (test/tests/constitutive_cost_repartitioner is meant to
+ * show it), so a problem with stateful properties is rejected unless
+ * allow_stateful_transfer is set.
+ */
+class ConstitutiveCostRepartitioner : public GeneralUserObject
+{
+public:
+  static InputParameters validParams();
+
+  ConstitutiveCostRepartitioner(const InputParameters & parameters);
+
+  virtual void initialSetup() override;
+  virtual void initialize() override {}
+  virtual void execute() override;
+  virtual void finalize() override {}
+
+protected:
+  /// elemental variable with the constitutive cost
+  const VariableName _cost_variable;
+
+  /// number of time steps between two imbalance checks
+  const unsigned int _interval;
+
+  /// repartition if the maximum cost per processor divided by the average exceeds this value
+  const Real _imbalance_tolerance;
+
+  /// repartition even though the problem has stateful material properties
+  const bool _allow_stateful_transfer;
+};
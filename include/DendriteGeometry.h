@@ -0,0 +1,78 @@
+#pragma once
+
+#include "ElementUserObject.h"
+#include "KDTree.h"
+
+/**
+ * DendriteGeometry holds the positions of the dendrite centres of the RVE
+ * (one or many, given in the input file or read from a file) in a k-d tree, and
+ * caches for every quadrature point the normalized radial distance to the nearest
+ * centre and whether the point lies in the core region used for slip band nucleation.
+ * The cache is filled when the object executes (initial by default) and is read by
+ * CrystalPlasticityDislocationDendrite and ComputeCrystalPlasticityResidualEigenstrain.
+ * It is keyed on the element ids, which adaptivity and repartitioning free, reuse and
+ * renumber, so it is cleared whenever the mesh changes. Points missing from the cache
+ * are computed on the fly. With a single centre nothing is cached: the nearest centre
+ * search is skipped and the formula costs less than the lookup.
+ */
+class DendriteGeometry : public ElementUserObject
+{
+public:
+  static InputParameters validParams();
+
+  DendriteGeometry(const InputParameters & parameters);
+
+  virtual void initialize() override;
+  virtual void execute() override;
+  virtual void threadJoin(const UserObject & y) override;
+  virtual void finalize() override {}
+
+  virtual void meshChanged() override;
+
+  /// normalized radial distance to the nearest dendrite centre at quadrature point qp of elem
+  Real normalizedDistance(const Elem * elem, unsigned int qp, const Point & p) const;
+
+  /// whether quadrature point qp of elem lies in the core region of the nearest dendrite centre
+  bool inCoreRegion(const Elem * elem, unsigned int qp, const Point & p) const;
+
+  /**
+   * Normalized radial distance of the in-plane offset (dx, dy) from a dendrite centre,
+   * for a dendrite of unit half spacing. This is the single dendrite formula
+   * that used to be duplicated in the materials. It keeps their r0 = sqrt(1 + x * x / y * y)
+   * on purpose: the expression evaluates to sqrt(1 + x^2), not sqrt(1 + (x / y)^2), and the
+   * calibrated microstructure and residual stress distributions rely on it.
+   */
+  static Real normalizedRadialDistance(Real dx, Real dy);
+
+protected:
+  struct QpGeometry
+  {
+    Real normalized_distance;
+    bool core;
+  };
+
+  /// computes the geometry information at point p
+  QpGeometry computeGeometry(const Point & p) const;
+
+  /// returns the cached geometry information, or computes it if it is not cached
+  QpGeometry qpGeometry(const Elem * elem, unsigned int qp, const Point & p) const;
+
+  /// dendrite centres
+  std::vector<Point> _centers;
+
+  /// centres projected on the z = 0 plane, used to build the k-d tree
+  std::vector<Point> _projected_centers;
+
+  /// k-d tree to find the nearest dendrite centre in the x-y plane
+  std::unique_ptr<KDTree> _kd_tree;
+
+  /// half of the dendrite spacing, used to normalize the distance
+  const Real _half_spacing;
+
+  /// radius and half height of the core region around each centre
+  const Real _core_radius;
+  const Real _core_half_height;
+
+  /// per-element, per-qp geometry information
+  std::unordered_map<dof_id_type, std::vector<QpGeometry>> _qp_geometry;
+};
@@ -0,0 +1,29 @@
+#pragma once
+
+#include "GeneralUserObject.h"
+
+/**
+ * MaterialPropertyMemoryReport estimates the memory taken by the material properties
+ * supplied by a list of materials. The size of each property at one quadrature point is
+ * its serialized size, it is multiplied by the number of quadrature points of the local
+ * elements in the blocks of the material and summed over the processors. The current
+ * state of the stateful properties is stored for every element, together with the old
+ * (and older) states; the other properties only hold the element being computed. The
+ * full table is written at the initial execution, and a one-line total on later ones
+ * (the total changes when the mesh is refined or repartitioned).
+ */
+class MaterialPropertyMemoryReport : public GeneralUserObject
+{
+public:
+  static InputParameters validParams();
+
+  MaterialPropertyMemoryReport(const InputParameters & parameters);
+
+  virtual void initialize() override {}
+  virtual void execute() override;
+  virtual void finalize() override {}
+
+protected:
+  /// names of the materials whose properties are reported
+  const std::vector<MaterialName> & _material_names;
+};
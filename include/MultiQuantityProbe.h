@@ -0,0 +1,65 @@
+#pragma once
+
+#include "GeneralReporter.h"
+
+namespace libMesh
+{
+class System;
+}
+
+/**
+ * MultiQuantityProbe samples any number of (auxiliary) variables at a list of probe points
+ * in a single pass, replacing one PointValue postprocessor per variable and point.
+ * The points are located once, and again only after the mesh changes: the element,
+ * dof indices and shape function values at each point are cached, so sampling is a
+ * dot product with the solution. All values are gathered with a single reduction and
+ * written as one vector per variable (plus the x, y, z coordinates of the points), which
+ * the CSV output writes to one file per time step. When point_names are given, one scalar
+ * value <variable>_<point name> is declared per variable and point instead, and the time
+ * history stays in the main CSV file as with PointValue postprocessors.
+ * Material properties are sampled through their MaterialRealAux variables.
+ */
+class MultiQuantityProbe : public GeneralReporter
+{
+public:
+  static InputParameters validParams();
+
+  MultiQuantityProbe(const InputParameters & parameters);
+
+  virtual void initialSetup() override;
+  virtual void meshChanged() override;
+
+  virtual void initialize() override {}
+  virtual void execute() override;
+  virtual void finalize() override {}
+
+protected:
+  /// finds the element owning each probe point and caches the dof indices and shape values
+  void locatePoints();
+
+  /// probe points
+  std::vector<Point> _points;
+
+  /// names of the sampled variables
+  const std::vector<VariableName> & _variable_names;
+
+  ///@{ system and variable number of each sampled variable
+  std::vector<const libMesh::System *> _systems;
+  std::vector<unsigned int> _variable_numbers;
+  ///@}
+
+  ///@{ per variable and point: dof indices and shape function values, empty if the point is not owned by this processor
+  std::vector<std::vector<std::vector<dof_id_type>>> _dof_indices;
+  std::vector<std::vector<std::vector<Real>>> _shape_values;
+  ///@}
+
+  ///@{ vector reporter values: coordinates of the points and one vector per variable
+  std::vector<Real> * _x;
+  std::vector<Real> * _y;
+  std::vector<Real> * _z;
+  std::vector<std::vector<Real> *> _values;
+  ///@}
+
+  /// scalar reporter values per variable and point, used instead of the vectors with point_names
+  std::vector<std::vector<Real *>> _point_values;
+};
@@ -0,0 +1,47 @@
+#pragma once
+
+#include "QuadraturePointMarker.h"
+
+/**
+ * SlipBandMarker drives h-adaptivity around the slip band computed in
+ * CrystalPlasticityDislocationDendrite::SB_evolution().
+ * An element is refined if any of its quadrature points
+ * - lies inside the slip band (the variable, e.g. inside_sb_region, is 1),
+ * - lies between the band limits D1_old - buffer_width <= A x + B y + C z <= D2_old + buffer_width,
+ * - has a damage gradient magnitude above damage_gradient_threshold (first order variables),
+ * - has an indicator value above indicator_threshold, e.g. the framework ValueJumpIndicator
+ *   on ave_damage, which is constant per element so that its gradient vanishes.
+ * All other elements are marked for coarsening (or left untouched if coarsen = false).
+ * Stateful material properties are projected onto the child elements by the framework.
+ */
+class SlipBandMarker : public QuadraturePointMarker
+{
+public:
+  static InputParameters validParams();
+
+  SlipBandMarker(const InputParameters & parameters);
+
+protected:
+  virtual MarkerValue computeQpMarker() override;
+
+  // band limits from the previous time step, same postprocessors as in CrystalPlasticityDislocationDendrite
+  const PostprocessorValue & _D1_old;
+  const PostprocessorValue & _D2_old;
+
+  // coefficients (A, B, C) of the slip band plane A x + B y + C z = D
+  const RealVectorValue _band_normal;
+
+  // distance added on both sides of the band limits
+  const Real _buffer_width;
+
+  // optional damage variable and the gradient magnitude above which elements are refined
+  const VariableGradient * const _grad_damage;
+  const Real _damage_gradient_threshold;
+
+  // optional indicator (error vector indexed by the element id) and its refinement threshold
+  const ErrorVector * const _indicator;
+  const Real _indicator_threshold;
+
+  // mark elements away from the band for coarsening
+  const bool _coarsen;
+};
@@ -0,0 +1,120 @@
+# Uniaxial tension with an incremental (stateful) stress: stress_xx = t in every element
+# as long as the old stress is carried over. The cost is concentrated in one corner, so
+# the repartitioner moves elements between the two processors at the beginning of step 2,
+# and the run is terminated if the stress of any element is not t afterwards.
+
+[GlobalParams]
+  displacements = 'disp_x disp_y'
+[]
+
+[Mesh]
+  [square]
+    type = GeneratedMeshGenerator
+    dim = 2
+    nx = 8
+    ny = 8
+  []
+  [Partitioner]
+    type = ConstitutiveCostPartitioner
+    cost_variable = cost
+  []
+[]
+
+[Modules/TensorMechanics/Master/all]
+  strain = SMALL
+  incremental = true
+  add_variables = true
+  generate_output = 'stress_xx'
+[]
+
+[AuxVariables]
+  [cost]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+[]
+
+[AuxKernels]
+  [cost]
+    type = FunctionAux
+    variable = cost
+    function = 'if(x < 0.25 & y < 0.25, 100, 1)'
+    execute_on = initial
+  []
+[]
+
+[BCs]
+  [left]
+    type = DirichletBC
+    variable = disp_x
+    boundary = left
+    value = 0
+  []
+  [bottom]
+    type = DirichletBC
+    variable = disp_y
+    boundary = bottom
+    value = 0
+  []
+  [right]
+    type = FunctionDirichletBC
+    variable = disp_x
+    boundary = right
+    function = '1e-3 * t'
+  []
+[]
+
+[Materials]
+  [elasticity]
+    type = ComputeIsotropicElasticityTensor
+    youngs_modulus = 1e3
+    poissons_ratio = 0
+  []
+  [stress]
+    type = ComputeFiniteStrainElasticStress
+  []
+[]
+
+[UserObjects]
+  [repartitioner]
+    type = ConstitutiveCostRepartitioner
+    cost_variable = cost
+    interval = 2
+    allow_stateful_transfer = true
+  []
+  [check]
+    type = Terminator
+    expression = 'failed > 0'
+    fail_mode = HARD
+    error_level = ERROR
+    message = 'The stateful stress was not carried over the repartitioning'
+  []
+[]
+
+[Postprocessors]
+  [stress_max]
+    type = ElementExtremeValue
+    variable = stress_xx
+    value_type = max
+  []
+  [stress_min]
+    type = ElementExtremeValue
+    variable = stress_xx
+    value_type = min
+  []
+  [failed]
+    type = ParsedPostprocessor
+    expression = 'if(max(abs(stress_max - t), abs(stress_min - t)) > 1e-8, 1, 0)'
+    pp_names = 'stress_max stress_min'
+    use_t = true
+  []
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = NEWTON
+  dt = 1
+  num_steps = 4
+  nl_abs_tol = 1e-12
+[]
+
@@ -0,0 +1,133 @@
+# Uniaxial tension with an incremental (stateful) stress: stress_xx = t in every element as
+# long as the old stress is projected onto the refined and coarsened elements. The left half
+# is in the "slip band" for the first two steps, refined, then coarsened back to the initial
+# mesh. The run fails (Terminator) if the stress is off or the mesh was not adapted.
+
+[GlobalParams]
+  displacements = 'disp_x disp_y'
+[]
+
+[Mesh]
+  [square]
+    type = GeneratedMeshGenerator
+    dim = 2
+    nx = 8
+    ny = 8
+  []
+[]
+
+[Modules/TensorMechanics/Master/all]
+  strain = SMALL
+  incremental = true
+  add_variables = true
+  generate_output = 'stress_xx'
+[]
+
+[AuxVariables]
+  [band]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+[]
+
+[AuxKernels]
+  [band]
+    type = FunctionAux
+    variable = band
+    function = 'if(t < 2.5 & x < 0.5, 1, 0)'
+    execute_on = 'initial timestep_end'
+  []
+[]
+
+[BCs]
+  [left]
+    type = DirichletBC
+    variable = disp_x
+    boundary = left
+    value = 0
+  []
+  [bottom]
+    type = DirichletBC
+    variable = disp_y
+    boundary = bottom
+    value = 0
+  []
+  [right]
+    type = FunctionDirichletBC
+    variable = disp_x
+    boundary = right
+    function = '1e-3 * t'
+  []
+[]
+
+[Materials]
+  [elasticity]
+    type = ComputeIsotropicElasticityTensor
+    youngs_modulus = 1e3
+    poissons_ratio = 0
+  []
+  [stress]
+    type = ComputeFiniteStrainElasticStress
+  []
+[]
+
+[Adaptivity]
+  marker = band_marker
+  max_h_level = 1
+  [Markers]
+    [band_marker]
+      type = SlipBandMarker
+      variable = band
+      D1_old = no_band
+      D2_old = no_band
+    []
+  []
+[]
+
+[Postprocessors]
+  [no_band]
+    type = Receiver
+  []
+  [stress_max]
+    type = ElementExtremeValue
+    variable = stress_xx
+    value_type = max
+  []
+  [stress_min]
+    type = ElementExtremeValue
+    variable = stress_xx
+    value_type = min
+  []
+  [n_elems]
+    type = NumElements
+  []
+  [max_elems]
+    type = TimeExtremeValue
+    postprocessor = n_elems
+  []
+  [failed]
+    type = ParsedPostprocessor
+    expression = 'if(max(abs(stress_max - t), abs(stress_min - t)) > 1e-8, 1, 0)
+                  + if(t > 4.5 & (max_elems <= 64 | n_elems > 64), 1, 0)'
+    pp_names = 'stress_max stress_min max_elems n_elems'
+    use_t = true
+  []
+[]
+
+[UserObjects]
+  [check]
+    type = Terminator
+    expression = 'failed > 0'
+    fail_mode = HARD
+    error_level = ERROR
+    message = 'The stateful stress was not carried over the adaptivity, or the mesh was not adapted'
+  []
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = NEWTON
+  dt = 1
+  num_steps = 5
+  nl_abs_tol = 1e-12
+[]